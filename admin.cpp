@@ -6,6 +6,11 @@
 #include <iomanip>
 #include <limits>
 #include <unordered_map>
+#include <filesystem>
+#include <future>
+#include <atomic>
+#include <thread>
+#include <algorithm>
 
 using namespace std;
 
@@ -31,9 +36,23 @@ vector<Produto> carregarProdutos(const string& nomeArquivo) {
     return produtos;
 }
 
+// Função para criar o diretório da loja só quando um arquivo dela for salvo
+void criarDiretorioArquivo(const string& nomeArquivo) {
+    filesystem::path diretorio = filesystem::path(nomeArquivo).parent_path();
+    if (!diretorio.empty()) {
+        error_code erro;
+        filesystem::create_directories(diretorio, erro); // Falhas aparecem ao abrir o arquivo
+    }
+}
+
 // Função para salvar produtos no arquivo
 void salvarProdutos(const vector<Produto>& produtos, const string& nomeArquivo) {
+    criarDiretorioArquivo(nomeArquivo);
     ofstream arquivo(nomeArquivo);
+    if (!arquivo.is_open()) {
+        cout << "Erro ao salvar os produtos no arquivo " << nomeArquivo << endl;
+        return;
+    }
     for (const auto& produto : produtos) {
         arquivo << produto.id << " " << produto.nome << " " << produto.vendidoPorPeso << " " 
                 << fixed << setprecision(2) << produto.valor << " "
@@ -246,6 +265,11 @@ struct Venda {
     string data;
 };
 
+// Função para ler uma venda no formato de "vendas.txt"
+bool lerVenda(istream& arquivo, Venda& venda) {
+    return static_cast<bool>(arquivo >> venda.id >> venda.nome >> venda.faturamento >> venda.quantidade >> venda.data);
+}
+
 // Função para carregar as vendas do arquivo "vendas.txt"
 vector<Venda> carregarVendas(const string& nomeArquivo) {
     vector<Venda> vendas;
@@ -253,7 +277,7 @@ vector<Venda> carregarVendas(const string& nomeArquivo) {
 
     if (arquivo.is_open()) {
         Venda venda;
-        while (arquivo >> venda.id >> venda.nome >> venda.faturamento >> venda.quantidade >> venda.data) {
+        while (lerVenda(arquivo, venda)) {
             vendas.push_back(venda);
         }
         arquivo.close();
@@ -268,19 +292,69 @@ bool dataNoIntervalo(const string& data, const string& dataInicio, const string&
     return data >= dataInicio && data <= dataFim;
 }
 
-// Função para gerar o relatório de vendas com base em uma data de início e uma data de fim
-void gerarRelatorioVendas(const vector<Venda>& vendas, const string& dataInicio, const string& dataFim) {
-    unordered_map<string, pair<double, double>> resumoVendas; // Map para acumular faturamento e quantidade por produto
+// Resumo de vendas por produto: nome -> (faturamento, quantidade).
+// O nome é a chave estável entre lojas, pois os IDs são reindexados em cada loja.
+using ResumoVendas = unordered_map<string, pair<double, double>>;
 
-    // Processa cada venda e acumula os dados para produtos no intervalo especificado
-    for (const auto& venda : vendas) {
+const string diretorioLojas = "lojas";
+
+// Função para validar o nome da loja (não pode sair do diretório "lojas")
+bool lojaValida(const string& loja) {
+    return !loja.empty() && loja != "." && loja.find("..") == string::npos
+        && loja.find('/') == string::npos && loja.find('\\') == string::npos;
+}
+
+// Função para montar o caminho de um arquivo dentro da loja (loja vazia = diretório atual)
+string caminhoLoja(const string& loja, const string& nomeArquivo) {
+    if (loja.empty()) return nomeArquivo;
+    return diretorioLojas + "/" + loja + "/" + nomeArquivo;
+}
+
+// Função para listar as lojas cadastradas (cada subdiretório de "lojas" é uma loja), em ordem alfabética.
+// A loja do diretório atual (nome vazio) entra primeiro quando tem arquivos próprios.
+vector<string> listarLojas() {
+    vector<string> lojas;
+    error_code erro;
+    if (filesystem::exists("produtos.txt", erro) || filesystem::exists("vendas.txt", erro)) {
+        lojas.push_back("");
+    }
+    for (const auto& entrada : filesystem::directory_iterator(diretorioLojas, erro)) {
+        error_code erroEntrada;
+        if (entrada.is_directory(erroEntrada)) {
+            lojas.push_back(entrada.path().filename().string());
+        }
+    }
+    sort(lojas.begin(), lojas.end());
+    return lojas;
+}
+
+// Função para acumular as vendas do intervalo no resumo
+void acumularVenda(ResumoVendas& resumo, const string& nome, double faturamento, double quantidade) {
+    auto& item = resumo[nome];
+    item.first += faturamento;   // Soma o faturamento
+    item.second += quantidade;   // Soma a quantidade
+}
+
+// Função para agregar as vendas de uma loja enquanto lê o arquivo, sem montar o vetor de vendas
+bool agregarVendasLoja(const string& loja, const string& dataInicio, const string& dataFim, ResumoVendas& resumo) {
+    const string nomeArquivo = caminhoLoja(loja, "vendas.txt");
+    error_code erro;
+    if (!filesystem::exists(nomeArquivo, erro) && !erro) return true; // Loja sem vendas ainda
+
+    ifstream arquivo(nomeArquivo);
+    if (!arquivo.is_open()) return false;
+
+    Venda venda;
+    while (lerVenda(arquivo, venda)) {
         if (dataNoIntervalo(venda.data, dataInicio, dataFim)) {
-            resumoVendas[venda.nome].first += venda.faturamento;  // Soma o faturamento
-            resumoVendas[venda.nome].second += venda.quantidade;  // Soma a quantidade
+            acumularVenda(resumo, venda.nome, venda.faturamento, venda.quantidade);
         }
     }
+    return true;
+}
 
-    // Exibe o relatório de vendas consolidado
+// Função para exibir o relatório de vendas consolidado
+void exibirRelatorioVendas(const ResumoVendas& resumoVendas, const string& dataInicio, const string& dataFim) {
     cout << "\nRelatório de Vendas de " << dataInicio << " a " << dataFim << ":\n";
     cout << setw(15) << "Produto" << setw(15) << "Faturamento" << setw(15) << "Quantidade" << endl;
 
@@ -304,13 +378,81 @@ void gerarRelatorioVendas(const vector<Venda>& vendas, const string& dataInicio,
     cout << "Total Quantidade Vendida: " << totalQuantidade << endl;
 }
 
-int main() {
+// Função para gerar o relatório de vendas com base em uma data de início e uma data de fim
+void gerarRelatorioVendas(const vector<Venda>& vendas, const string& dataInicio, const string& dataFim) {
+    ResumoVendas resumoVendas; // Map para acumular faturamento e quantidade por produto
+
+    // Processa cada venda e acumula os dados para produtos no intervalo especificado
+    for (const auto& venda : vendas) {
+        if (dataNoIntervalo(venda.data, dataInicio, dataFim)) {
+            acumularVenda(resumoVendas, venda.nome, venda.faturamento, venda.quantidade);
+        }
+    }
+
+    exibirRelatorioVendas(resumoVendas, dataInicio, dataFim);
+}
+
+// Função para gerar o relatório consolidado de várias lojas.
+// As lojas são agregadas em paralelo por um número limitado de trabalhadores, que pegam
+// a próxima loja de um índice compartilhado; os resumos parciais são somados no final.
+void gerarRelatorioVendas(const vector<string>& lojas, const string& dataInicio, const string& dataFim) {
+    vector<ResumoVendas> parciais(lojas.size());
+    vector<char> lidas(lojas.size(), false);
+    atomic<size_t> proxima(0);
+
+    auto trabalhador = [&]() {
+        for (size_t i = proxima++; i < lojas.size(); i = proxima++) {
+            lidas[i] = agregarVendasLoja(lojas[i], dataInicio, dataFim, parciais[i]);
+        }
+    };
+
+    // A thread atual também trabalha, então o limite de threads extras é um a menos
+    size_t limite = max(1u, thread::hardware_concurrency());
+    size_t numTrabalhadores = min(limite, lojas.size());
+    vector<future<void>> tarefas;
+    for (size_t t = 1; t < numTrabalhadores; ++t) {
+        try {
+            tarefas.push_back(async(launch::async, trabalhador));
+        } catch (const system_error&) {
+            break; // Sem novas threads: as lojas restantes ficam com quem já está trabalhando
+        }
+    }
+    trabalhador();
+    for (auto& tarefa : tarefas) {
+        tarefa.get();
+    }
+
+    ResumoVendas resumoVendas;
+    size_t lojasConsolidadas = 0;
+    for (size_t i = 0; i < lojas.size(); ++i) {
+        if (!lidas[i]) {
+            cout << "Erro ao abrir o arquivo " << caminhoLoja(lojas[i], "vendas.txt") << endl;
+            continue;
+        }
+        for (const auto& item : parciais[i]) {
+            acumularVenda(resumoVendas, item.first, item.second.first, item.second.second);
+        }
+        ++lojasConsolidadas;
+    }
+
+    cout << "\nLojas consolidadas: " << lojasConsolidadas << " de " << lojas.size() << endl;
+    exibirRelatorioVendas(resumoVendas, dataInicio, dataFim);
+}
+
+int main(int argc, char* argv[]) {
     std::setlocale(LC_ALL, "en_US.UTF-8");
-    
-    const string nomeArquivo = "produtos.txt";
+
+    // Loja opcional: "admin <loja>" usa lojas/<loja>/; sem argumento usa o diretório atual
+    const string loja = argc > 1 ? argv[1] : "";
+    if (argc > 1 && !lojaValida(loja)) {
+        cout << "Nome de loja inválido: " << loja << "\n";
+        return 1;
+    }
+
+    const string nomeArquivo = caminhoLoja(loja, "produtos.txt");
     vector<Produto> produtos = carregarProdutos(nomeArquivo);
 
-    const string nomeArquivoVendas = "vendas.txt";
+    const string nomeArquivoVendas = caminhoLoja(loja, "vendas.txt");
     vector<Venda> vendas = carregarVendas(nomeArquivoVendas);
 
 
@@ -355,7 +497,18 @@ int main() {
             cout << "Digite a data de fim (AAAA-MM-DD): ";
             cin >> dataFim;
 
-            gerarRelatorioVendas(vendas, dataInicio, dataFim);
+            vector<string> lojas = listarLojas();
+            string consolidar;
+            if (lojas.size() > 1) {
+                cout << "Consolidar todas as " << lojas.size() << " lojas? (digite 'sim' para confirmar): ";
+                cin >> consolidar;
+            }
+
+            if (consolidar == "sim") {
+                gerarRelatorioVendas(lojas, dataInicio, dataFim);
+            } else {
+                gerarRelatorioVendas(vendas, dataInicio, dataFim);
+            }
         } else if (opcao == 6) {
             cout << "Saindo...\n";
         } else {
@@ -6,6 +6,7 @@
 #include <iomanip>
 #include <ctime>
 #include <sstream>
+#include <filesystem>
 
 using namespace std;
 
@@ -31,6 +32,20 @@ string obterDataAtual() {
     return buffer;
 }
 
+const string diretorioLojas = "lojas";
+
+// Função para validar o nome da loja (não pode sair do diretório "lojas")
+bool lojaValida(const string& loja) {
+    return !loja.empty() && loja != "." && loja.find("..") == string::npos
+        && loja.find('/') == string::npos && loja.find('\\') == string::npos;
+}
+
+// Função para montar o caminho de um arquivo dentro da loja (loja vazia = diretório atual)
+string caminhoLoja(const string& loja, const string& nomeArquivo) {
+    if (loja.empty()) return nomeArquivo;
+    return diretorioLojas + "/" + loja + "/" + nomeArquivo;
+}
+
 // Função para carregar produtos do arquivo
 vector<Produto> carregarProdutos(const string& nomeArquivo) {
     vector<Produto> produtos;
@@ -55,8 +70,18 @@ vector<Produto> carregarProdutos(const string& nomeArquivo) {
     return produtos;
 }
 
+// Função para criar o diretório da loja só quando um arquivo dela for salvo
+void criarDiretorioArquivo(const string& nomeArquivo) {
+    filesystem::path diretorio = filesystem::path(nomeArquivo).parent_path();
+    if (!diretorio.empty()) {
+        error_code erro;
+        filesystem::create_directories(diretorio, erro); // Falhas aparecem ao abrir o arquivo
+    }
+}
+
 // Função para salvar produtos no arquivo após atualização
 void salvarProdutos(const vector<Produto>& produtos, const string& nomeArquivo) {
+    criarDiretorioArquivo(nomeArquivo);
     ofstream arquivo(nomeArquivo, ios::trunc);
     if (arquivo.is_open()) {
         for (const auto& produto : produtos) {
@@ -174,9 +199,10 @@ void removerProduto(vector<ItemCompra>& carrinho, vector<Produto>& produtos) {
 }
 
 // Função para atualizar o arquivo de vendas
-void atualizarVendas(const vector<ItemCompra>& carrinho) {
+void atualizarVendas(const vector<ItemCompra>& carrinho, const string& nomeArquivoVendas) {
     string dataAtual = obterDataAtual();
-    fstream arquivo("vendas.txt", ios::in | ios::out | ios::app);
+    criarDiretorioArquivo(nomeArquivoVendas);
+    fstream arquivo(nomeArquivoVendas, ios::in | ios::out | ios::app);
 
     if (!arquivo.is_open()) {
         cout << "Erro ao abrir o arquivo de vendas.\n";
@@ -203,12 +229,13 @@ void atualizarVendas(const vector<ItemCompra>& carrinho) {
             istringstream iss(linhaExistente);
             iss >> idProduto >> nomeProduto >> valorTotal >> quantidadeTotal >> data;
 
-            if (idProduto == item.produto.id && data == dataAtual) {
+            // O nome é a chave estável do produto entre lojas; o ID muda quando o admin reindexa
+            if (nomeProduto == item.produto.nome && data == dataAtual) {
                 valorTotal += item.quantidade * item.produto.valor;
                 quantidadeTotal += item.quantidade;
 
                 ostringstream novaLinha;
-                novaLinha << idProduto << " " << nomeProduto << " "
+                novaLinha << item.produto.id << " " << nomeProduto << " "
                           << fixed << setprecision(2) << valorTotal << " "
                           << quantidadeTotal << " " << data;
 
@@ -227,7 +254,7 @@ void atualizarVendas(const vector<ItemCompra>& carrinho) {
         }
     }
 
-    ofstream outFile("vendas.txt", ios::trunc);
+    ofstream outFile(nomeArquivoVendas, ios::trunc);
     for (const auto& linha : linhas) {
         outFile << linha << "\n";
     }
@@ -236,7 +263,7 @@ void atualizarVendas(const vector<ItemCompra>& carrinho) {
 }
 
 // Função para fechar a compra e exibir o total
-void fecharCompra(vector<ItemCompra>& carrinho, vector<Produto>& produtos, const string& nomeArquivoProdutos) {
+void fecharCompra(vector<ItemCompra>& carrinho, vector<Produto>& produtos, const string& nomeArquivoProdutos, const string& nomeArquivoVendas) {
     float total = 0.0;
     for (const auto& item : carrinho) {
         float valorProduto = item.quantidade * item.produto.valor;
@@ -247,15 +274,23 @@ void fecharCompra(vector<ItemCompra>& carrinho, vector<Produto>& produtos, const
     }
     cout << "Total da compra: R$ " << fixed << setprecision(2) << total << "\n";
 
-    atualizarVendas(carrinho);
+    atualizarVendas(carrinho, nomeArquivoVendas);
     salvarProdutos(produtos, nomeArquivoProdutos);
     carrinho.clear();
 }
 
-int main() {
+int main(int argc, char* argv[]) {
      std::setlocale(LC_ALL, "en_US.UTF-8");
 
-    const string nomeArquivo = "produtos.txt";
+    // Loja opcional: "caixa <loja>" usa lojas/<loja>/; sem argumento usa o diretório atual
+    const string loja = argc > 1 ? argv[1] : "";
+    if (argc > 1 && !lojaValida(loja)) {
+        cout << "Nome de loja inválido: " << loja << "\n";
+        return 1;
+    }
+
+    const string nomeArquivo = caminhoLoja(loja, "produtos.txt");
+    const string nomeArquivoVendas = caminhoLoja(loja, "vendas.txt");
     vector<Produto> produtos = carregarProdutos(nomeArquivo);
     vector<ItemCompra> carrinho;
 
@@ -285,7 +320,7 @@ int main() {
                 removerProduto(carrinho, produtos);
                 break;
             case 3:
-                fecharCompra(carrinho, produtos, nomeArquivo);
+                fecharCompra(carrinho, produtos, nomeArquivo, nomeArquivoVendas);
                 break;
             case 4:
                 carrinho.clear();